@@ -0,0 +1,34 @@
+#!/bin/sh
+# Cost of an analysis cache hit against a miss on a synthetic input. The input is analyzed
+# twice with the same --cache-dir, the first run misses on every function and the second hits.
+# Prints CSV "run,seconds,hits,misses,ms_per_hit,ms_per_miss" and fails if the records of the
+# two runs differ.
+#
+# usage: cache_hits.sh PASS [FUNCTIONS]
+set -e
+
+PASS=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+FUNCTIONS=${2:-200}
+GEN=$(cd "$(dirname "$0")" && pwd)/gen_synthetic.py
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+cd "$WORK"
+
+python3 "$GEN" --functions "$FUNCTIONS" -o synthetic.c
+
+echo "run,seconds,hits,misses,ms_per_hit,ms_per_miss"
+for run in cold warm; do
+    start=$(date +%s%N)
+    "$PASS" --format jsonl --cache-dir cache --parallelize synthetic.c > "$run.jsonl"
+    end=$(date +%s%N)
+    seconds=$(awk -v ns=$((end - start)) 'BEGIN { printf "%.3f", ns / 1e9 }')
+    grep '"record":"cache"' "$run.jsonl" |
+        sed 's/.*"hits":\([0-9]*\),"misses":\([0-9]*\),"ms_per_hit":\([^,]*\),"ms_per_miss":\([^}]*\)}.*/\1,\2,\3,\4/' |
+        sed "s/^/$run,$seconds,/"
+    grep -v '"record":"cache"' "$run.jsonl" > "$run.records"
+done
+if ! cmp -s cold.records warm.records; then
+    echo "records of the warm run differ from the cold run" >&2
+    exit 1
+fi
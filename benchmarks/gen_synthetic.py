@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Generate a synthetic C input for benchmarking MyFirstRosePass.
+
+Every function holds a few loop nests over global arrays. Each statement writes
+one array element and reads the rest of its refs, with subscripts that are
+either affine in the surrounding induction variables (i1 + 1, i0 - 1, ...) or
+indirect through an index array (idx[i1]).
+"""
+
+import argparse
+import random
+import sys
+
+
+def subscript(rng, depth, indirect_ratio):
+    ivar = "i%d" % rng.randrange(depth)
+    if rng.random() < indirect_ratio:
+        return "idx[%s]" % ivar
+    offset = rng.choice((-1, 0, 0, 1))
+    if offset == 0:
+        return ivar
+    return "%s %s %d" % (ivar, "+" if offset > 0 else "-", abs(offset))
+
+
+def array_ref(rng, args):
+    name = "arr%d" % rng.randrange(args.arrays)
+    return name + "".join("[%s]" % subscript(rng, args.depth, args.indirect_ratio) for _ in range(args.depth))
+
+
+def generate(args, out):
+    rng = random.Random(args.seed)
+    out.write("#define N %d\n\n" % args.size)
+    out.write("int idx[N];\n")
+    for a in range(args.arrays):
+        out.write("double arr%d%s;\n" % (a, "[N]" * args.depth))
+
+    for f in range(args.functions):
+        out.write("\nvoid kernel_%d(void)\n{\n" % f)
+        out.write("    int %s;\n" % ", ".join("i%d" % d for d in range(args.depth)))
+        for _ in range(args.nests):
+            for d in range(args.depth):
+                indent = "    " * (d + 1)
+                out.write("%sfor (i%d = 1; i%d < N - 1; i%d++)\n" % (indent, d, d, d))
+            indent = "    " * args.depth
+            out.write("%s{\n" % indent)
+            for _ in range(args.statements):
+                reads = [array_ref(rng, args) for _ in range(max(args.refs_per_stmt - 1, 1))]
+                out.write("%s    %s = %s;\n" % (indent, array_ref(rng, args), " + ".join(reads)))
+            out.write("%s}\n" % indent)
+        out.write("}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--functions", type=int, default=100)
+    parser.add_argument("--nests", type=int, default=2, help="loop nests per function")
+    parser.add_argument("--depth", type=int, default=2, help="loop nest depth, also the array rank")
+    parser.add_argument("--statements", type=int, default=2, help="statements per loop nest")
+    parser.add_argument("--refs-per-stmt", type=int, default=3, help="array refs per statement, one of them written")
+    parser.add_argument("--arrays", type=int, default=4, help="number of distinct arrays")
+    parser.add_argument("--indirect-ratio", type=float, default=0.1, help="fraction of subscripts through idx[]")
+    parser.add_argument("--size", type=int, default=64, help="value of N")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("-o", "--output", help="output file, stdout by default")
+    args = parser.parse_args()
+
+    if args.output:
+        with open(args.output, "w") as out:
+            generate(args, out)
+    else:
+        generate(args, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,31 @@
+#!/bin/sh
+# Run the pass over synthetic inputs of increasing size and report time and RSS delta
+# per phase (frontend, loop_sweep, pair_enumeration, backend, function_body) as CSV on stdout:
+#   config,functions,depth,refs_per_stmt,arrays,indirect_ratio,phase,seconds,rss_delta_kb
+#
+# usage: run_bench.sh PASS
+set -e
+
+PASS=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+GEN=$(cd "$(dirname "$0")" && pwd)/gen_synthetic.py
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+cd "$WORK"
+
+echo "config,functions,depth,refs_per_stmt,arrays,indirect_ratio,phase,seconds,rss_delta_kb"
+
+# name functions depth refs_per_stmt arrays indirect_ratio
+while read -r name functions depth refs arrays indirect; do
+    python3 "$GEN" --functions "$functions" --depth "$depth" --refs-per-stmt "$refs" \
+        --arrays "$arrays" --indirect-ratio "$indirect" -o "$name.c"
+    "$PASS" --phase-times "$name.csv" "$name.c" > "$name.txt"
+    tail -n +2 "$name.csv" | sed "s/^/$name,$functions,$depth,$refs,$arrays,$indirect,/"
+done <<CONFIGS
+small 10 2 3 4 0.1
+wide 200 2 3 4 0.1
+deep 50 4 3 4 0.1
+dense 50 2 8 2 0.1
+many_arrays 50 2 4 32 0.1
+indirect 50 2 3 4 0.5
+CONFIGS
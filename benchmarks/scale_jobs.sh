@@ -0,0 +1,37 @@
+#!/bin/sh
+# Scaling of --jobs on a synthetic input with many independent functions, for the text and the
+# JSON Lines report. Prints CSV "format,jobs,seconds,speedup" and fails if any run's report
+# differs from the --jobs 1 run. The text report is compared apart from the node addresses it
+# prints, which change from process to process, the JSON Lines report byte for byte.
+#
+# usage: scale_jobs.sh PASS [MAX_JOBS] [FUNCTIONS]
+set -e
+
+PASS=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+MAX_JOBS=${2:-8}
+FUNCTIONS=${3:-200}
+GEN=$(cd "$(dirname "$0")" && pwd)/gen_synthetic.py
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+cd "$WORK"
+
+python3 "$GEN" --functions "$FUNCTIONS" -o synthetic.c
+
+echo "format,jobs,seconds,speedup"
+for format in text jsonl; do
+    jobs=1
+    while [ "$jobs" -le "$MAX_JOBS" ]; do
+        start=$(date +%s%N)
+        "$PASS" --jobs "$jobs" --format "$format" --parallelize synthetic.c | sed 's/@0x[0-9a-f]*/@/g' > "report_${format}_$jobs.txt"
+        end=$(date +%s%N)
+        ns=$((end - start))
+        [ "$jobs" -eq 1 ] && serial_ns=$ns
+        echo "$format,$jobs,$(awk -v ns=$ns -v serial=$serial_ns 'BEGIN { printf "%.3f,%.2f", ns / 1e9, serial / ns }')"
+        if ! cmp -s "report_${format}_1.txt" "report_${format}_$jobs.txt"; then
+            echo "$format report of --jobs $jobs differs from --jobs 1" >&2
+            exit 1
+        fi
+        jobs=$((jobs * 2))
+    done
+done
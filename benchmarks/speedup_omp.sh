@@ -0,0 +1,51 @@
+#!/bin/sh
+# Speedup of the --parallelize output on the reference kernels. Every kernel is run through the
+# pass, the original and the emitted rose_*.c are compiled with -fopenmp, and both are timed on
+# 1, 2, 4, ... threads. Prints CSV "kernel,version,threads,seconds" and fails if the pass inserts
+# no pragma or the output does not compile.
+# Everything is built at -O2. jacobi's arrays are local and never read after the kernel, so plain -O2
+# deletes the kernel. jacobi keeps -O2 and turns off only dead code and dead store elimination.
+# Run it on a multicore host, the speedup is only meaningful up to the number of cores.
+#
+# usage: speedup_omp.sh PASS [MAX_THREADS]
+set -e
+
+PASS=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+MAX_THREADS=${2:-$(nproc)}
+BENCH=$(cd "$(dirname "$0")" && pwd)
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+cd "$WORK"
+
+seconds() {
+    start=$(date +%s%N)
+    OMP_NUM_THREADS=$1 "./$2"
+    end=$(date +%s%N)
+    awk -v ns=$((end - start)) 'BEGIN { printf "%.3f", ns / 1e9 }'
+}
+
+echo "kernel,version,threads,seconds"
+
+# file function declaration flags
+while read -r file function declaration flags; do
+    cp "$BENCH/$file" .
+    "$PASS" --parallelize "$file" > "$file.txt"
+    if ! grep -q "omp parallel for" "rose_$file"; then
+        echo "no parallel for in rose_$file" >&2
+        exit 1
+    fi
+    echo "$declaration $function(); int main(void) { $function(); return 0; }" > "main_$function.c"
+    gcc $flags -fopenmp "$file" "main_$function.c" -o "${function}_original"
+    gcc $flags -fopenmp "rose_$file" "main_$function.c" -o "${function}_parallel"
+
+    echo "$function,original,1,$(seconds 1 "${function}_original")"
+    threads=1
+    while [ "$threads" -le "$MAX_THREADS" ]; do
+        echo "$function,parallel,$threads,$(seconds "$threads" "${function}_parallel")"
+        threads=$((threads * 2))
+    done
+done <<KERNELS
+testF.c mmm int -O2
+testA.c jacobi void -O2 -fno-tree-dce -fno-tree-dse -fno-dce -fno-dse
+KERNELS